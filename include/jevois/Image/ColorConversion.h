@@ -24,11 +24,13 @@ extern "C"
   
   //! Convert from YUYV to RGB, mostly intended for internal use. Use RawImage functions instead in most cases.
   /*! This code is modified from here: http://pastebin.com/mDcwqJV3
-      Memory should have been allocated by caller. \ingroup image */
+      Memory should have been allocated by caller. Rows are processed in parallel, using SIMD instructions when
+      available. If w is odd, the last pixel of each row only has Y and U, and uses the V of the previous pixel
+      pair. \ingroup image */
   void convertYUYVtoRGB24(unsigned int w, unsigned int h, unsigned char const * src, unsigned char * dst);
   
   //! Convert from YUYV to RG, BY, and luminance for use by Saliency module in jevoisbase. For internal use.
-  /*! \ingroup image */
+  /*! Same YUYV to RGB conversion and odd width handling as convertYUYVtoRGB24(). \ingroup image */
   void convertYUYVtoRGBYL(unsigned int w, unsigned int h, unsigned char const * src, int * dstrg,
                           int * dstby, int * dstlum, int thresh, int inputbits);
 